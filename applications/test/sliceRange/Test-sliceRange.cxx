@@ -5,7 +5,7 @@
     \\  /    A nd           | www.openansys.com
      \\/     M anipulation  |
 -------------------------------------------------------------------------------
-    Copyright (C) 2019-2023 OpenCFD Ltd.
+    Copyright (C) 2019-2026 OpenCFD Ltd.
 -------------------------------------------------------------------------------
 License
     This file is part of OpenFOAM.
@@ -35,6 +35,8 @@ Description
 #include "IndirectList.H"
 #include "IndirectSubList.H"
 #include "SliceList.H"
+#include "ComponentSliceList.H"
+#include "vectorField.H"
 #include "Random.H"
 
 using namespace Foam;
@@ -277,6 +279,34 @@ int main(int argc, char *argv[])
     }
 
 
+    // Component views
+    {
+        vectorField fld(4);
+
+        forAll(fld, i)
+        {
+            fld[i] = vector(i, 10 + i, 20 + i);
+        }
+
+        ComponentSliceList<vector> fldy(fld, vector::Y);
+
+        Info<< nl << "y-component: " << flatOutput(fldy)
+            << " stride " << fldy.addressing().stride() << nl;
+
+        for (scalar& val : fldy)
+        {
+            val = -val;
+        }
+
+        Info<< "Changed via y-component: " << flatOutput(fld) << nl;
+
+        ComponentSliceList<vector> fldz(fld, vector::Z);
+        fldz = scalarField(fld.size(), Zero);
+
+        Info<< "z-component from list: " << flatOutput(fld) << nl;
+    }
+
+
     // For loops
     {
         Info<< nl << "Test for loops" << nl;